@@ -137,14 +137,58 @@ def plot_radial_density(atom_name):
     print(f"Saved: {atom_name}_charge_density.png")
     plt.show()
 
+def load_compact(filename):
+    """Load a ChebyshevRadial .cheb file, return f(r) evaluating the fit at arbitrary r"""
+    with open(filename) as fin:
+        fin.readline()
+        n_panels, degree = (int(x) for x in fin.readline().split())
+        edges = np.array(fin.readline().split(), dtype=float)
+        coef = np.loadtxt(fin).reshape(n_panels, degree + 1)
+
+    def evaluate(r):
+        x = np.clip(np.log(np.maximum(np.asarray(r, dtype=float), 1e-300)), edges[0], edges[-1])
+        panel = np.searchsorted(edges[1:-1], x, side='right')
+        t = 2 * (x - edges[panel]) / (edges[panel + 1] - edges[panel]) - 1
+        # Clenshaw recurrence, vectorized over r
+        b1 = np.zeros_like(t)
+        b2 = np.zeros_like(t)
+        for k in range(degree, 0, -1):
+            b1, b2 = 2 * t * b1 - b2 + coef[panel, k], b1
+        return t * b1 - b2 + coef[panel, 0]
+
+    return evaluate
+
+def plot_compact(filename):
+    """Plot a compact .cheb fit on a fine grid"""
+    if not os.path.exists(filename):
+        print(f"Error: File {filename} not found")
+        return
+
+    f = load_compact(filename)
+    r = np.linspace(1e-4, 15, 5000)
+    label = os.path.splitext(os.path.basename(filename))[0]
+
+    plt.figure(figsize=(10, 6))
+    plt.plot(r, f(r), linewidth=2, label=label)
+    plt.xlabel('r (Bohr)', fontsize=12)
+    plt.ylabel('f(r)', fontsize=12)
+    plt.title(f'{label} (Chebyshev fit)', fontsize=14)
+    plt.grid(True, alpha=0.3)
+    plt.legend(fontsize=11)
+    plt.tight_layout()
+    plt.savefig(f'{label}_compact.png', dpi=300)
+    print(f"Saved: {label}_compact.png")
+    plt.show()
+
 def main():
     if len(sys.argv) < 2:
         print("Usage: python3 visualize.py <atom_name> [mode]")
-        print("Modes: 'all' (default), 'single <filename>', 'density'")
+        print("Modes: 'all' (default), 'single <filename>', 'density', 'compact <filename>'")
         print("\nExamples:")
         print("  python3 visualize.py C              # Plot all C wavefunctions")
         print("  python3 visualize.py C single C_n1l0_nodes0.dat  # Plot specific file")
         print("  python3 visualize.py C density       # Plot charge density")
+        print("  python3 visualize.py C compact C_n_1_l_0.cheb  # Plot compact fit")
         sys.exit(1)
     
     atom_name = sys.argv[1]
@@ -154,6 +198,8 @@ def main():
         plot_wavefunction(sys.argv[3])
     elif mode == 'density':
         plot_radial_density(atom_name)
+    elif mode == 'compact' and len(sys.argv) > 3:
+        plot_compact(sys.argv[3])
     else:
         plot_all_wavefunctions(atom_name)
 
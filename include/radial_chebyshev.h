@@ -0,0 +1,218 @@
+#pragma once
+#include <cmath>
+#include <vector>
+#include <string>
+#include <fstream>
+#include <iomanip>
+#include <algorithm>
+#include <functional>
+
+// Compact representation of a radial function f(r) (unl, density, U_Hartree).
+// Piecewise Chebyshev series in x = log(r). Panels are refined only where needed, so widths differ:
+// panel lookup is a binary search over the edges, O(log n_panels).
+// Outside [r_min, r_max] the end value is returned and the derivative is 0.
+struct ChebyshevRadial {
+    int degree = 0;
+    int n_panels = 0;
+    std::vector<double> edges; // n_panels + 1 panel edges in x, increasing
+    std::vector<double> coef; // n_panels * (degree + 1), panel-major
+
+    // Panel index and local coordinate t in [-1, 1]. Returns false if r is outside the range (incl. r <= 0).
+    bool Locate(double r, int& panel, double& t) const {
+        double x = r > 0. ? std::log(r) : edges.front();
+        bool inside = (r > 0. && x >= edges.front() && x <= edges.back());
+        x = std::min(std::max(x, edges.front()), edges.back());
+        panel = static_cast<int>(std::upper_bound(edges.begin() + 1, edges.end() - 1, x) - (edges.begin() + 1));
+        t = 2. * (x - edges[panel]) / (edges[panel + 1] - edges[panel]) - 1.;
+        return inside;
+    }
+    // Clenshaw recurrence for sum c_k T_k(t)
+    double Series(int panel, double t) const {
+        const double* c = &coef[static_cast<std::size_t>(panel) * (degree + 1)];
+        double b1 = 0., b2 = 0.;
+        for (int k = degree; k > 0; --k) {
+            double b0 = 2. * t * b1 - b2 + c[k];
+            b2 = b1;
+            b1 = b0;
+        }
+        return t * b1 - b2 + c[0];
+    }
+    // sum c_k T_k'(t) with T_k' = k U_{k-1}
+    double Series_dt(int panel, double t) const {
+        const double* c = &coef[static_cast<std::size_t>(panel) * (degree + 1)];
+        double U_km2 = 0., U_km1 = 1.; // U_{-1}, U_0
+        double sum = 0.;
+        for (int k = 1; k <= degree; ++k) {
+            sum += k * c[k] * U_km1;
+            double U_k = 2. * t * U_km1 - U_km2;
+            U_km2 = U_km1;
+            U_km1 = U_k;
+        }
+        return sum;
+    }
+    double Value(double r) const {
+        int panel;
+        double t;
+        Locate(r, panel, t);
+        return Series(panel, t);
+    }
+    // df/dr = df/dt * dt/dx * dx/dr
+    double Derivative(double r) const {
+        int panel;
+        double t;
+        if (!Locate(r, panel, t)) {
+            return 0.;
+        }
+        return Series_dt(panel, t) * (2. / (edges[panel + 1] - edges[panel])) / r;
+    }
+    void Evaluate(const std::vector<double>& r, std::vector<double>& f) const {
+        f.resize(r.size());
+        for (std::size_t i = 0; i < r.size(); ++i) {
+            f[i] = Value(r[i]);
+        }
+    }
+    void Evaluate(const std::vector<double>& r, std::vector<double>& f, std::vector<double>& df) const {
+        f.resize(r.size());
+        df.resize(r.size());
+        for (std::size_t i = 0; i < r.size(); ++i) {
+            f[i] = Value(r[i]);
+            df[i] = Derivative(r[i]);
+        }
+    }
+    // Text format: header line, "n_panels degree", one line of n_panels + 1 edges, then one panel of coefficients per line
+    bool Write(const std::string& filename) const {
+        std::ofstream fout(filename);
+        if (!fout) {
+            return false;
+        }
+        fout << "# ChebyshevRadial: x = log(r), panel edges in x\n";
+        fout << n_panels << " " << degree << "\n" << std::setprecision(17);
+        for (int p = 0; p <= n_panels; ++p) {
+            fout << edges[p] << (p == n_panels ? "\n" : " ");
+        }
+        for (int p = 0; p < n_panels; ++p) {
+            for (int k = 0; k <= degree; ++k) {
+                fout << coef[static_cast<std::size_t>(p) * (degree + 1) + k] << (k == degree ? "\n" : " ");
+            }
+        }
+        return static_cast<bool>(fout);
+    }
+    static bool Read(const std::string& filename, ChebyshevRadial& out) {
+        std::ifstream fin(filename);
+        std::string header;
+        if (!fin || !std::getline(fin, header)) {
+            return false;
+        }
+        fin >> out.n_panels >> out.degree;
+        if (!fin || out.n_panels < 1 || out.degree < 0) {
+            return false;
+        }
+        out.edges.resize(static_cast<std::size_t>(out.n_panels) + 1);
+        for (double& x : out.edges) {
+            fin >> x;
+        }
+        out.coef.resize(static_cast<std::size_t>(out.n_panels) * (out.degree + 1));
+        for (double& x : out.coef) {
+            fin >> x;
+        }
+        return static_cast<bool>(fin);
+    }
+};
+
+// Fit f on r_grid (increasing, r_grid[0] > 0) to max |fit - f| <= tol * max |f|.
+// Starts from 8 equal panels in x and halves only the panels that fail. A panel is checked on the grid points
+// it contains and at points between its Chebyshev nodes, where values come from 4-point Lagrange interpolation
+// in r (needed where the grid is sparse in log r, e.g. below r_grid[1] on the uniform grid).
+// Returns false if a panel cannot be refined further (width < 1E-6 of the range, or coefficients would exceed the
+// number of grid points); max_error is the achieved error.
+inline bool Fit_ChebyshevRadial(const std::vector<double>& r_grid, const std::vector<double>& f, double tol,
+                                ChebyshevRadial& fit, double& max_error, int degree = 12) {
+    const std::size_t N = r_grid.size();
+    const double PI_cheb = 3.141592653589793;
+    const int m = degree + 1;
+    auto Sample = [&](double r) {
+        std::size_t j = static_cast<std::size_t>(std::upper_bound(r_grid.begin(), r_grid.end(), r) - r_grid.begin());
+        std::size_t i0 = (j < 2) ? 0 : std::min(j - 2, N - 4);
+        double value = 0.;
+        for (std::size_t a = i0; a < i0 + 4; ++a) {
+            double w = 1.;
+            for (std::size_t b = i0; b < i0 + 4; ++b) {
+                if (b != a) {
+                    w *= (r - r_grid[b]) / (r_grid[a] - r_grid[b]);
+                }
+            }
+            value += w * f[a];
+        }
+        return value;
+    };
+    std::vector<double> x_grid(N);
+    double f_max = 0.;
+    for (std::size_t i = 0; i < N; ++i) {
+        x_grid[i] = std::log(r_grid[i]);
+        f_max = std::max(f_max, std::abs(f[i]));
+    }
+    const double tol_abs = tol * f_max;
+    const double x_min = x_grid.front(), x_max = x_grid.back();
+    const double width_min = 1E-6 * (x_max - x_min);
+    fit = ChebyshevRadial();
+    fit.degree = degree;
+    fit.edges.push_back(x_min);
+    max_error = 0.;
+    bool success = true;
+    const int n_start = 8;
+    const std::size_t panels_max = std::max<std::size_t>(N / m, n_start);
+    std::size_t panels = n_start; // Current number of leaves, incl. panels not fitted yet
+    std::vector<double> values(m), c(m);
+    // Chebyshev series of one panel in t
+    auto Series = [&](double t) {
+        double b1 = 0., b2 = 0.;
+        for (int k = degree; k > 0; --k) {
+            double b0 = 2. * t * b1 - b2 + c[k];
+            b2 = b1;
+            b1 = b0;
+        }
+        return t * b1 - b2 + c[0];
+    };
+    // Panels are fitted left to right, so edges and coef stay ordered
+    std::function<void(double, double)> Fit_panel = [&](double a, double b) {
+        double center = 0.5 * (a + b), half = 0.5 * (b - a);
+        for (int j = 0; j < m; ++j) {
+            values[j] = Sample(std::exp(center + half * std::cos(PI_cheb * (j + 0.5) / m)));
+        }
+        for (int k = 0; k < m; ++k) {
+            double sum = 0.;
+            for (int j = 0; j < m; ++j) {
+                sum += values[j] * std::cos(PI_cheb * k * (j + 0.5) / m);
+            }
+            c[k] = (k == 0 ? 1. : 2.) * sum / m;
+        }
+        double error = 0.;
+        std::size_t i = static_cast<std::size_t>(std::lower_bound(x_grid.begin(), x_grid.end(), a) - x_grid.begin());
+        for (; i < N && x_grid[i] <= b; ++i) {
+            error = std::max(error, std::abs(Series((x_grid[i] - center) / half) - f[i]));
+        }
+        for (int j = 0; j <= m; ++j) { // Between Chebyshev nodes
+            double t = std::cos(PI_cheb * j / m);
+            error = std::max(error, std::abs(Series(t) - Sample(std::exp(center + half * t))));
+        }
+        if (error > tol_abs && b - a > width_min && panels < panels_max) {
+            ++panels;
+            Fit_panel(a, center);
+            Fit_panel(center, b);
+            return;
+        }
+        if (error > tol_abs) {
+            success = false;
+        }
+        max_error = std::max(max_error, error);
+        fit.edges.push_back(b);
+        fit.coef.insert(fit.coef.end(), c.begin(), c.end());
+        ++fit.n_panels;
+    };
+    for (int p = 0; p < n_start; ++p) {
+        double a = x_min + (x_max - x_min) * p / n_start;
+        double b = (p == n_start - 1) ? x_max : x_min + (x_max - x_min) * (p + 1) / n_start;
+        Fit_panel(a, b);
+    }
+    return success;
+}
@@ -49,8 +49,11 @@
     #include <algorithm>
     #include <tuple>
     #include "atom_database.h"
+    #include "radial_chebyshev.h"
     #include <complex>
     #include <map>
+    #include <functional>
+    #include <limits>
     #include <Eigen/Dense>
 
 
@@ -72,12 +75,32 @@
     // Schrodinger Loop iteration config
     const int Iter_max = 100;
     const double E_converge = 1E-5; // must greater than U_Hartree tol and Schrodinger tol
+    const double E_start_Schrodinger = -150.; //@v9 -50 //@v10 -100 < P @v10 -150 < Ca
+    const bool Channel_solver = true; // Solve all orbitals with same l together: Solve_Schrodinger_Channel(). false: Solve_Schrodinger() per orbital
     const double density_smear_cutoff = 1E-20;
     // Grid parameters
     const double log_min = std::log(rmin);
     const double log_max = std::log(rmax);
     const double log_step = (log_max - log_min) / static_cast<double>(Nx);
     // x[i] expression: log_min + (log_step * i) = x_min + (dx * i)
+    inline double Grid_step(const std::vector<double>& r_grid){ // log_step of a grid with r_grid.size() - 1 intervals
+        return (log_max - log_min) / static_cast<double>(r_grid.size() - 1);
+    }
+    // Adaptive inner tolerance config: Hartree/Schrodinger tolerances follow SCF residual, see Tolerance_Controller
+    const bool Adaptive_tolerance = true;
+    const double Inner_safety = 0.1; // Inner energy tolerance = Inner_safety * SCF residual
+    const double Inner_loose_dE = 1E-3; // Loosest Schrodinger energy tolerance (Hartree)
+    const double Inner_max_loosen = 1E3; // Max factor on tight Hartree / Schrodinger residual tolerances
+    const double Stall_ratio = 0.9; // SCF residual must drop below Stall_ratio * previous, otherwise force tightening
+    const double Stall_shrink = 0.1;
+    const bool Measure_fixed_baseline = false; // Also run SCF with fixed tolerances and report measured savings (doubles cost)
+    // Compact output config
+    const bool Write_compact = true; // Also write Chebyshev fits (*.cheb) of unl, density and U_Hartree at convergence
+    const double Compact_tol = 1E-8; // Max fit error relative to max |f| on r_grid
+    // Richardson extrapolation config
+    const bool Richardson_extrapolate = false; // Run SCF on Nx/4, Nx/2, Nx and extrapolate to continuum limit
+    const int Richardson_levels = 3; //@ >= 3, order is observed from the last 3. Grid sizes: Nx / 2^(levels-1), ..., Nx/2, Nx
+    const double Richardson_E_converge = 1E-9; // SCF tolerance per level, must be well below level-to-level differences
 
     //Initialize atomic config
     struct AtomData {
@@ -106,21 +129,24 @@
         std::vector<double> grid;
         std::vector<double> density;
     };
-    InitializeStruct Initialize_n(double Z_nucleus, int Ntot){
+    InitializeStruct Initialize_n(double Z_nucleus, int Ntot, int N_grid = Nx){
         // uniform grid ---------------------------------------------------
-        std::vector<double> r_grid(Nx + 1);
-        double dx = rmax / static_cast<double>(Nx);
-        for(std::size_t i = 0; i < r_grid.size(); ++i){
-            r_grid[i] = i * dx;
-        }
-        r_grid[0] = 1E-8; // Make huge difference 1E-8 is required dont touch.
-        // exponential ---------------------------------------------------
-        // std::vector<double> r_grid(Nx + 1); // Choose log10 for 10 is a integer
+        // Inconsistent with the log step of Hartree_Numerov() / Numerov_ynl(): results depend on Nx without a limit.
+        // std::vector<double> r_grid(N_grid + 1);
+        // double dx = rmax / static_cast<double>(N_grid);
         // for(std::size_t i = 0; i < r_grid.size(); ++i){
-        //     r_grid[i] = std::pow(E_numb, log_min + (log_step * i));
+        //     r_grid[i] = i * dx;
         // }
+        // r_grid[0] = 1E-8; // Make huge difference 1E-8 is required dont touch.
+        // exponential ---------------------------------------------------
+        // x[i] = log_min + Grid_step(r_grid) * i, the grid the Numerov kernels step on
+        std::vector<double> r_grid(N_grid + 1);
+        const double grid_step = Grid_step(r_grid);
+        for(std::size_t i = 0; i < r_grid.size(); ++i){
+            r_grid[i] = std::exp(log_min + (grid_step * i));
+        }
         //---------------------------------------------------
-        std::vector<double> density(Nx + 1);
+        std::vector<double> density(N_grid + 1);
         for (std::size_t i = 0; i < density.size(); ++i)
         {
             density[i] = Z_nucleus * Z_nucleus * std::exp(-1. * Z_nucleus * r_grid[i]); // Better than T-F density.
@@ -193,6 +219,24 @@
         fout.close();
     }
 
+    void Write_compact_radial(const std::vector<double>& r_grid, const std::vector<double>& f_lst, std::string title = "test") {
+        std::ostringstream filename_stream;
+        filename_stream << title << ".cheb";
+        std::string filename = filename_stream.str();
+        double max_error;
+        ChebyshevRadial fit;
+        bool fit_converged = Fit_ChebyshevRadial(r_grid, f_lst, Compact_tol, fit, max_error);
+        if (!fit.Write(filename)) {
+            std::cerr << "Error: Cannot open file for writing! filename = " << filename << "\n";
+            return;
+        }
+        if (!fit_converged) {
+            std::cerr << "Warning: Compact fit did not reach Compact_tol! filename = " << filename << "\tMax error = " << max_error << "\n";
+        }
+        std::cout << "Done: Compact file is written. filename = " << filename << "\tPanels = " << fit.n_panels
+                  << "\tCoefficients = " << fit.coef.size() << " (grid points = " << r_grid.size() << ")\tMax error = " << max_error << std::endl;
+    }
+
     void Write_xy(const std::vector<double>& x_lst, const std::vector<double>& y_lst, std::string title = "test") {
         std::ostringstream filename_stream;
         filename_stream << title << ".dat";
@@ -214,14 +258,18 @@
         // std::cout << "Max value = " << *max_it << "\tMin value = " << *min_it << std::endl;
     }
 
-    void Hartree_Numerov(const std::vector<double>& r_grid, const std::vector<double>& density, std::vector<double>& U_Hartree, int Ntot){
+    int Hartree_Numerov(const std::vector<double>& r_grid, const std::vector<double>& density, std::vector<double>& U_Hartree, int Ntot,
+                        double tol = 1E-9 / std::sqrt(rmin)){ // Returns Numerov sweeps: 2 per Newton step + 1
         std::vector<double> h_Hartree(r_grid.size());
         std::vector<double> Y_Hartree(r_grid.size());
+        const double log_step = Grid_step(r_grid);
         for(std::size_t i = 0; i < r_grid.size(); ++i){
             h_Hartree[i] = -4. * PI * std::pow(r_grid[i], 5./2.) * density[i];
         }
         double Y2BC_init;
+        int sweeps = 0;
         auto Solve_Y = [&](double Y2BC_init, std::vector<double>& Y_Hartree){
+            ++sweeps;
             Y_Hartree.back() = static_cast<double>(Ntot) / std::sqrt(rmax);
             *(Y_Hartree.end()-2) = Y2BC_init;
             for (std::size_t i = (Y_Hartree.size() - 2); i > 0; --i)
@@ -233,7 +281,7 @@
         auto Solve_Y_Newton = [&](double Y2BC, std::vector<double>& Y_Hartree){
             int iter = 0;
             double alpha = 1E-1 / std::sqrt(rmax); //@ 1E-3
-            const double tol = 1E-9 / std::sqrt(rmin); //@ 1E-4; 1E-9
+            // tol: //@ 1E-4; 1E-9 / std::sqrt(rmin). Set by Tolerance_Controller
             double residue_prev = 0;
             const int iter_max = 1000;
             std::vector<double> Y_Hartree_new(r_grid.size(), 0.);
@@ -277,6 +325,7 @@
         Solve_Y_Newton(Y2BC_init, Y_Hartree);
         Y_2_U(Y_Hartree, U_Hartree);
         Write_xy(r_grid, U_Hartree, "U_Hartree");
+        return sweeps;
     }
     //Compute K-S potential
     class KS_Potential{ //Ctors: r_grid; U_Hartree; density
@@ -351,75 +400,85 @@
         }
     };
 
-    int Solve_Schrodinger(const std::vector<double>& r_grid, const std::vector<double>& V_effective, OrbitalStruct& orbital, double &E_start){
+    // Numerov sweep from rmax inwards for y(x) = u(r) / sqrt(r) at trial energy. Shared by Solve_Schrodinger() and Solve_Schrodinger_Channel()
+    // rescale: keep |ynl| < 1E100 to avoid overflow. Recurrence is linear, node positions are unchanged but ynl.front() is no longer absolute.
+    void Numerov_ynl(const std::vector<double>& r_grid, const std::vector<double>& V_effective, int l, double energy, std::vector<double>& ynl, bool rescale = false){
+        const double log_step = Grid_step(r_grid);
+        std::vector<double> p_KS(r_grid.size());
+        for(std::size_t i = 0; i < r_grid.size(); ++i){
+            p_KS[i] = 2. * (V_effective[i] - energy )* r_grid[i] * r_grid[i] + static_cast<double>(l * (l+1)) + 1./4.;
+        }
+        ynl.back() = 0.;
+        *(ynl.end() - 2) = 1E-6 / std::sqrt(rmax); //@ 1E-6
+        for (std::size_t i = (r_grid.size() - 2); i >0 ; --i){
+            ynl[i-1] = (2.*ynl[i]*(1.+ (5./12.)*p_KS[i]*log_step*log_step) - ynl[i+1]*(1.- (1./12.)*p_KS[i+1]*log_step*log_step))/
+                    (1.-(1./12.)*p_KS[i-1]*log_step*log_step);
+            if(rescale && std::abs(ynl[i-1]) > 1E100){
+                for(std::size_t j = i - 1; j < ynl.size(); ++j){
+                    ynl[j] *= 1E-100;
+                }
+            }
+        }
+    }
+    int Count_nodes(const std::vector<double>& ynl){
+        int nodes = 0;
+        for (std::size_t i = 6; i < ynl.size() - 5; ++i) { // skip the boundary region
+            if (ynl[i] * ynl[i - 1] < 0) {
+                nodes++;
+            }
+        }
+        return nodes;
+    }
+    void y_2_unl(const std::vector<double>& r_grid, const std::vector<double>& ynl, std::vector<double>& unl)
+    {
+        for (std::size_t i = 0; i < ynl.size(); ++i)
+        {
+            unl[i] = ynl[i] * std::sqrt(r_grid[i]);
+        }
+    }
+    void Normalize_unl(const std::vector<double>& r_grid, std::vector<double> &unl)
+    {
+        double norm_factor = 0.;
+        double f_iminus1, f_i, f_iplus1;
+        for (std::size_t i = 1; i < r_grid.size(); i += 2)
+        {
+            if (i == 1)
+            {
+                f_iminus1 = unl[i - 1] * unl[i - 1];
+            }
+            else
+            {
+                f_iminus1 = f_iplus1;
+            }
+            f_i = unl[i] * unl[i];
+            f_iplus1 = unl[i + 1] * unl[i + 1];
+            norm_factor += (f_iminus1 + 4. * f_i + f_iplus1) * (r_grid[i + 1] - r_grid[i - 1]) / 6.;
+        }
+        norm_factor = std::sqrt(norm_factor);
+        for (std::size_t i = 0; i < r_grid.size(); ++i)
+        {
+            unl[i] /= norm_factor;
+        }
+    }
+
+    int Solve_Schrodinger(const std::vector<double>& r_grid, const std::vector<double>& V_effective, OrbitalStruct& orbital, double &E_start,
+                          int& sweeps_total, double tol = 1E-7 / std::sqrt(rmin), double tol_dE = 1E-18){
         int n = orbital.Orb_n;
         int l = orbital.Orb_l;
         const int Total_Nodes = n - l - 1;
         int nodes_prev = 1000;
         const int iter_max = 5000; //@v9 3000
         int iter = 0;
-        double tol_dE = 1E-18;
-        double tol = 1E-7  / std::sqrt(rmin); //@ 1E-6; less than E_converge is required!
+        // tol_dE: 1E-18; tol: 1E-7 / std::sqrt(rmin) //@ 1E-6; less than E_converge is required! Set by Tolerance_Controller
         double dE = 1E-1; //@ 1E-1 or 1E-2
         double Enl;
         double residue_prev = 0.;
-        auto Solve_ynl = [&](double energy, std::vector<double>& ynl){ //lambda: [capture list that compose func body. use `&` to save memory from copy `=`] (parameter list that lambda works on) { body }
-            std::vector<double> p_KS(r_grid.size());
-            for(std::size_t i = 0; i < r_grid.size(); ++i){
-                p_KS[i] = 2. * (V_effective[i] - energy )* r_grid[i] * r_grid[i] + static_cast<double>(l * (l+1)) + 1./4.;
-            }
-            ynl.back() = 0.;
-            *(ynl.end() - 2) = 1E-6 / std::sqrt(rmax); //@ 1E-6
-            for (std::size_t i = (r_grid.size() - 2); i >0 ; --i){
-                ynl[i-1] = (2.*ynl[i]*(1.+ (5./12.)*p_KS[i]*log_step*log_step) - ynl[i+1]*(1.- (1./12.)*p_KS[i+1]*log_step*log_step))/
-                        (1.-(1./12.)*p_KS[i-1]*log_step*log_step);
-            }
-        };
-        auto Count_nodes = [&](const std::vector<double>& ynl){
-            int nodes = 0;
-            for (std::size_t i = 6; i < ynl.size() - 5; ++i) { // skip the boundary region
-                if (ynl[i] * ynl[i - 1] < 0) {
-                    nodes++;
-                }
-            }
-            return nodes;
-        };
-        auto y_2_unl = [&](const std::vector<double>& ynl, std::vector<double>& unl)
-        {
-            for (std::size_t i = 0; i < ynl.size(); ++i)
-            {
-                unl[i] = ynl[i] * std::sqrt(r_grid[i]);
-            }
-        };
-        auto Normalize_unl = [&](std::vector<double> &unl)
-        {
-            double norm_factor = 0.;
-            double f_iminus1, f_i, f_iplus1;
-            for (std::size_t i = 1; i < r_grid.size(); i += 2)
-            {
-                if (i == 1)
-                {
-                    f_iminus1 = unl[i - 1] * unl[i - 1];
-                }
-                else
-                {
-                    f_iminus1 = f_iplus1;
-                }
-                f_i = unl[i] * unl[i];
-                f_iplus1 = unl[i + 1] * unl[i + 1];
-                norm_factor += (f_iminus1 + 4. * f_i + f_iplus1) * (r_grid[i + 1] - r_grid[i - 1]) / 6.;
-            }
-            norm_factor = std::sqrt(norm_factor);
-            for (std::size_t i = 0; i < r_grid.size(); ++i)
-            {
-                unl[i] /= norm_factor;
-            }
-        };
         std::vector<double> ynl(r_grid.size(), 0.);
         std::vector<double> unl(r_grid.size(), 0.);
         Enl = E_start;
         while (iter < iter_max && Enl < 0.0) {
-            Solve_ynl(Enl, ynl);
+            Numerov_ynl(r_grid, V_effective, l, Enl, ynl);
+            ++sweeps_total;
             int nodes = Count_nodes(ynl);
             if((std::abs(ynl.front()) < tol || dE < tol_dE) && nodes == Total_Nodes) {
                 break;
@@ -435,9 +494,9 @@
             }
             ++iter;
         }
-        y_2_unl(ynl, unl);
+        y_2_unl(r_grid, ynl, unl);
         // Normalize WF
-        Normalize_unl(unl);
+        Normalize_unl(r_grid, unl);
         orbital.Orb_Enl = Enl;
         orbital.Orb_unl = unl;
         if (std::abs(ynl.back()) < tol && nodes_prev == Total_Nodes)
@@ -454,6 +513,218 @@
         }
     }
 
+    // Solve every orbital of one l-channel at once. Node count of one sweep = number of eigenvalues below trial energy,
+    // so brackets [E_lo, E_hi] are split (Sturm bisection) until each holds a single target node count; these sweeps are shared.
+    // Each root is then refined on its own: Sturm bisection down to a single node-count jump, then Illinois regula falsi on
+    // g(E) = ynl.front() / max|ynl| (scale free, so continuous although sweeps are rescaled). Refinement is paid per root
+    // (~15 sweeps to machine precision on Ca, vs ~52 with bisection only). tol_dE: bracket width, Tight_tolerance.Channel_tol_dE
+    // on tight SCF iterations, never below the machine resolution of E. If an orbital is not bound in V_effective, E_hi is raised
+    // above 0 and the box state with its node count is kept (reported as not converged). sweeps_total accumulates sweeps.
+    int Solve_Schrodinger_Channel(const std::vector<double>& r_grid, const std::vector<double>& V_effective, std::vector<OrbitalStruct*>& channel, double E_start,
+                                  int& sweeps_total, double tol_dE = 1E-12){
+        const int l = channel.front()->Orb_l;
+        const int iter_max = 200; // steps per root
+        int sweeps = 0;
+        int error_code = 0;
+        std::vector<double> ynl(r_grid.size(), 0.);
+        std::vector<double> unl(r_grid.size(), 0.);
+        double E_swept = 0.; // Energy of the sweep currently in ynl
+        std::map<double, std::pair<int, double>> swept; // energy -> (Sturm count, g)
+        auto Sweep = [&](double energy){ // Count_nodes() + node in the skipped boundary region: jumps exactly where ynl.front() = 0
+            auto it = swept.find(energy);
+            if(it != swept.end()){
+                return it->second;
+            }
+            Numerov_ynl(r_grid, V_effective, l, energy, ynl, true);
+            ++sweeps;
+            E_swept = energy;
+            double y_max = 0.;
+            for(double y : ynl){
+                y_max = std::max(y_max, std::abs(y));
+            }
+            std::pair<int, double> result(Count_nodes(ynl) + (ynl.front() * ynl[5] < 0 ? 1 : 0), y_max > 0. ? ynl.front() / y_max : 0.);
+            swept[energy] = result;
+            return result;
+        };
+        auto Sweep_nodes = [&](double energy){
+            return Sweep(energy).first;
+        };
+        std::vector<int> targets;
+        for(const OrbitalStruct* x : channel){
+            targets.push_back(x->Orb_n - l - 1);
+        }
+        const int target_min = *std::min_element(targets.begin(), targets.end());
+        // Outer bracket: bound states lie in [E_lo, 0)
+        double E_lo = E_start;
+        int nodes_lo = Sweep_nodes(E_lo);
+        while(nodes_lo > target_min && E_lo > -1E6){
+            E_lo *= 2.;
+            nodes_lo = Sweep_nodes(E_lo);
+        }
+        double E_hi = 0.;
+        int nodes_hi = Sweep_nodes(E_hi);
+        const int target_max = *std::max_element(targets.begin(), targets.end());
+        while(nodes_hi <= target_max && E_hi < 1E2){ // Unbound in this potential (e.g. over-screened first guess): box states above E = 0
+            E_hi = (E_hi == 0.) ? 1E-1 : 2. * E_hi;
+            nodes_hi = Sweep_nodes(E_hi);
+        }
+        // Split brackets until each contains at most one target node count
+        std::map<int, std::pair<double, double>> isolated; // target nodes -> bracket
+        std::function<void(double, int, double, int, int)> Isolate = [&](double lo, int n_lo, double hi, int n_hi, int depth){
+            std::vector<int> inside;
+            for(int k : targets){
+                if(k >= n_lo && k < n_hi){
+                    inside.push_back(k);
+                }
+            }
+            if(inside.empty()){
+                return;
+            }
+            if(inside.size() == 1 || depth >= iter_max){
+                for(int k : inside){
+                    isolated[k] = {lo, hi};
+                }
+                return;
+            }
+            double mid = 0.5 * (lo + hi);
+            int n_mid = Sweep_nodes(mid);
+            Isolate(lo, n_lo, mid, n_mid, depth + 1);
+            Isolate(mid, n_mid, hi, n_hi, depth + 1);
+        };
+        Isolate(E_lo, nodes_lo, E_hi, nodes_hi, 0);
+        const int sweeps_isolate = sweeps;
+        // Refine each root: N(E) <= k below the eigenvalue, N(E) > k above
+        for(std::size_t m = 0; m < channel.size(); ++m){
+            OrbitalStruct& orbital = *channel[m];
+            const int Total_Nodes = targets[m];
+            auto it = isolated.find(Total_Nodes);
+            if(it == isolated.end()){
+                std::cout << "[✘] Error: Schrodinger did not converge! No eigenvalue bracket below E = " << E_hi << ". Wavefunction Config:" << std::endl;
+                std::cout << "E range = [" << E_lo << ", " << E_hi << "]\tnodes range = [" << nodes_lo << ", " << nodes_hi << "]\tn = " << orbital.Orb_n << "\tl = " << l << "\tTarget nodes = " << Total_Nodes << std::endl;
+                error_code = 1;
+                Sweep_nodes(E_hi); // Keep the E_hi state, Update_density() needs every orbital
+                y_2_unl(r_grid, ynl, unl);
+                Normalize_unl(r_grid, unl);
+                orbital.Orb_Enl = E_hi;
+                orbital.Orb_unl = unl;
+                continue;
+            }
+            double lo = it->second.first, hi = it->second.second;
+            auto Width_converged = [&](){
+                double resolution = 8. * std::numeric_limits<double>::epsilon() * std::max(std::abs(lo), std::abs(hi));
+                return (hi - lo) <= std::max(tol_dE, resolution);
+            };
+            int iter = 0;
+            // Sturm bisection until the bracket holds a single jump k -> k + 1
+            while(iter < iter_max && !Width_converged() && !(Sweep_nodes(lo) == Total_Nodes && Sweep_nodes(hi) == Total_Nodes + 1)){
+                double mid = 0.5 * (lo + hi);
+                if(Sweep_nodes(mid) <= Total_Nodes){
+                    lo = mid;
+                }
+                else{
+                    hi = mid;
+                }
+                ++iter;
+            }
+            // Illinois regula falsi on g(E), sign change between lo and hi; bisection step if g does not bracket
+            double g_lo = Sweep(lo).second, g_hi = Sweep(hi).second;
+            int side = 0;
+            bool exact = false; // g(E_try) == 0: E_try is the eigenvalue whatever its node count
+            while(iter < iter_max && !Width_converged()){
+                double E_try = 0.5 * (lo + hi);
+                if(g_lo * g_hi < 0.){
+                    double E_falsi = hi - g_hi * (hi - lo) / (g_hi - g_lo);
+                    if(E_falsi > lo && E_falsi < hi){
+                        E_try = E_falsi;
+                    }
+                }
+                std::pair<int, double> result = Sweep(E_try);
+                ++iter;
+                if(result.second == 0.){
+                    lo = hi = E_try;
+                    exact = true;
+                    break;
+                }
+                if(result.first <= Total_Nodes){
+                    lo = E_try;
+                    g_lo = result.second;
+                    if(side == -1){
+                        g_hi *= 0.5;
+                    }
+                    side = -1;
+                }
+                else{
+                    hi = E_try;
+                    g_hi = result.second;
+                    if(side == 1){
+                        g_lo *= 0.5;
+                    }
+                    side = 1;
+                }
+            }
+            const bool converged = Width_converged();
+            // Result on the correct side of the eigenvalue
+            double Enl = lo;
+            const double g_lo_sweep = Sweep(lo).second, g_hi_sweep = Sweep(hi).second; // Cached, not Illinois-halved
+            int nodes = Sweep_nodes(Enl);
+            if(!exact && g_lo_sweep * g_hi_sweep < 0.){
+                // Off the eigenvalue the inward sweep carries the solution irregular at r = 0 (ynl ~ r^(-l-1/2)), which dominates
+                // unl and the density for l > 0 on a loose bracket. Sweeps are linear in it, so the combination of the lo and hi
+                // sweeps with ynl.front() = 0 removes it up to O(hi - lo). Costs 2 sweeps.
+                auto Sweep_scaled = [&](double energy, std::vector<double>& y){ // ynl / max|ynl|, the scale g uses
+                    Numerov_ynl(r_grid, V_effective, l, energy, y, true);
+                    ++sweeps;
+                    double y_max = 0.;
+                    for(double v : y){
+                        y_max = std::max(y_max, std::abs(v));
+                    }
+                    for(double& v : y){
+                        v /= y_max;
+                    }
+                };
+                std::vector<double> y_hi(r_grid.size(), 0.);
+                Sweep_scaled(lo, ynl);
+                Sweep_scaled(hi, y_hi);
+                for(std::size_t i = 0; i < ynl.size(); ++i){
+                    ynl[i] = (g_hi_sweep * ynl[i] - g_lo_sweep * y_hi[i]) / (g_hi_sweep - g_lo_sweep);
+                }
+                E_swept = std::numeric_limits<double>::quiet_NaN(); // ynl is no single sweep
+            }
+            else{
+                if(E_swept != Enl){
+                    swept.erase(Enl);
+                }
+                Sweep_nodes(Enl);
+            }
+            if(l > 0){ // Centrifugal core, l(l+1) / 2r^2 >> |V - E|: regular ynl ~ r^(l+1/2), the combination above leaves O((hi - lo)^2) of the irregular one
+                std::size_t i_core = 0;
+                while(i_core + 1 < ynl.size() && l * (l + 1) / (2. * r_grid[i_core] * r_grid[i_core]) > 100. * std::abs(V_effective[i_core] - Enl)){
+                    ++i_core;
+                }
+                for(std::size_t i = 0; i < i_core; ++i){
+                    ynl[i] = ynl[i_core] * std::pow(r_grid[i] / r_grid[i_core], l + 0.5);
+                }
+            }
+            y_2_unl(r_grid, ynl, unl);
+            Normalize_unl(r_grid, unl);
+            orbital.Orb_Enl = Enl;
+            orbital.Orb_unl = unl;
+            if(converged && (nodes == Total_Nodes || exact) && Enl < 0.){ // Enl >= 0: box state kept until the orbital binds
+                std::cout << "[✔] Done: Schrodinger converged via Sturm bisection + regula falsi Numerov! Wavefunction Config:" << std::endl;
+                std::cout << "iter = " << iter << "\tE = " << Enl << "\tdE = " << (hi - lo) << "\tunl boundary = " << unl.front() << "\tn = " << orbital.Orb_n << "\tl = " << l << "\tCurrent nodes = " << nodes << "\tTarget nodes = " << Total_Nodes << std::endl;
+            }
+            else{
+                std::cout << "[✘] Error: Schrodinger did not converge! Wavefunction Config:" << std::endl;
+                std::cout << "iter = " << iter << "\tE = " << Enl << "\tdE = " << (hi - lo) << "\tunl boundary = " << unl.front() << "\tn = " << orbital.Orb_n << "\tl = " << l << "\tCurrent nodes = " << nodes << "\tTarget nodes = " << Total_Nodes << std::endl;
+                error_code = 1;
+            }
+        }
+        std::cout << "Done: l = " << l << " channel\tOrbitals = " << channel.size() << "\tSweeps = " << sweeps
+                << " (isolation = " << sweeps_isolate << ", refinement = " << sweeps - sweeps_isolate << ")" << std::endl;
+        sweeps_total += sweeps;
+        return error_code;
+    }
+
     std::tuple<double, double, double> Wrap_TotalEnergy(const std::vector<double> &r_grid, const std::vector<double> &density, const std::vector<double> &U_Hartree,
                                                         const std::vector<double> &V_exchange, const std::vector<double> &E_exchange, 
                                                         const std::vector<double> &V_correlation, const std::vector<double> &E_correlation, const std::vector<OrbitalStruct> &Atom)
@@ -524,12 +795,190 @@
         density = new_density;
     }
 
-    int main(){
-        auto [Atom_config, atom_name] = Select_Atom();
+    double Density_residual(const std::vector<double>& r_grid, const std::vector<double>& density_out, const std::vector<double>& density_in){ // Electrons moved: int 4 pi r^2 |n_out - n_in| dr
+        double residual = 0.;
+        double f_iminus1, f_i, f_iplus1;
+        for (std::size_t i = 1; i < r_grid.size(); i += 2)
+        {
+            if (i == 1)
+            {
+                f_iminus1 = 4. * PI * r_grid[i - 1] * r_grid[i - 1] * std::abs(density_out[i - 1] - density_in[i - 1]);
+            }
+            else
+            {
+                f_iminus1 = f_iplus1;
+            }
+            f_i = 4. * PI * r_grid[i] * r_grid[i] * std::abs(density_out[i] - density_in[i]);
+            f_iplus1 = 4. * PI * r_grid[i + 1] * r_grid[i + 1] * std::abs(density_out[i + 1] - density_in[i + 1]);
+            residual += (f_iminus1 + 4. * f_i + f_iplus1) * (r_grid[i + 1] - r_grid[i - 1]) / 6.;
+        }
+        return residual;
+    }
+
+    //Inner solver tolerances for one SCF iteration
+    struct InnerTolerance {
+        double Hartree_tol; // |Y_Hartree[0]| in Hartree_Numerov()
+        double Schrodinger_tol; // |ynl[0]| in Solve_Schrodinger()
+        double Schrodinger_tol_dE; // Energy step in Solve_Schrodinger()
+        double Channel_tol_dE; // Bracket width in Solve_Schrodinger_Channel()
+    };
+    const InnerTolerance Tight_tolerance = {1E-9 / std::sqrt(rmin), 1E-7 / std::sqrt(rmin), 1E-18, 1E-12};
+    // Inexact SCF: loose inner tolerances while the density is far from self-consistent.
+    // Energy tolerance = Inner_safety * |EDiff|, never loosened again, tightened by Stall_shrink if |EDiff| stalls,
+    // and set to Tight_tolerance once |EDiff| < SCF threshold (E_converge by default). Convergence is only accepted on a tight iteration.
+    class Tolerance_Controller{
+    private:
+        const double E_tol; // SCF convergence threshold of this run
+        const bool adaptive;
+        double tol_E;
+        double residual_prev;
+        int sweeps_Hartree = 0, sweeps_Schrodinger = 0; // Numerov sweeps, each one pass over r_grid
+        int scf_total = 0, scf_tight = 0;
+    public:
+        // residual_guess: expected |EDiff| of the starting density (warm start), caps the first tolerance
+        Tolerance_Controller(double E_tol_ctors = E_converge, bool adaptive_ctors = Adaptive_tolerance, double residual_guess = HUGE_VAL)
+            :E_tol(E_tol_ctors), adaptive(adaptive_ctors), tol_E(Tight_tolerance.Schrodinger_tol_dE), residual_prev(HUGE_VAL){
+                if(adaptive){
+                    tol_E = std::max(Tight_tolerance.Schrodinger_tol_dE, std::min(Inner_loose_dE, Inner_safety * residual_guess));
+                }
+            }
+        bool Is_tight() const {
+            return tol_E <= Tight_tolerance.Schrodinger_tol_dE;
+        }
+        InnerTolerance Current() const {
+            if(Is_tight()){
+                return Tight_tolerance;
+            }
+            double factor = std::min(std::max(tol_E / E_tol, 1.), Inner_max_loosen);
+            return {Tight_tolerance.Hartree_tol * factor, Tight_tolerance.Schrodinger_tol * factor, tol_E, std::max(tol_E, Tight_tolerance.Channel_tol_dE)};
+        }
+        void Record(int sweeps_Hartree_iter, int sweeps_Schrodinger_iter){ // Sweeps of one SCF iteration at Current()
+            sweeps_Hartree += sweeps_Hartree_iter;
+            sweeps_Schrodinger += sweeps_Schrodinger_iter;
+            ++scf_total;
+            if(Is_tight()){
+                ++scf_tight;
+            }
+        }
+        // Before the first energy difference: density residual (electrons moved) as a proxy for the first tolerance.
+        // Different units, so it never enters residual_prev / the stall check.
+        void Seed(double density_residual){
+            if(adaptive){
+                tol_E = std::max(Tight_tolerance.Schrodinger_tol_dE, std::min(tol_E, Inner_safety * density_residual));
+            }
+        }
+        void Update(double residual){ // |EDiff|
+            if(!adaptive){
+                return;
+            }
+            double target = Inner_safety * residual;
+            if(residual > Stall_ratio * residual_prev){ // Stalled: inner noise may be limiting SCF
+                target = std::min(target, tol_E * Stall_shrink);
+            }
+            if(residual < E_tol){
+                target = Tight_tolerance.Schrodinger_tol_dE;
+            }
+            tol_E = std::max(Tight_tolerance.Schrodinger_tol_dE, std::min(tol_E, target));
+            residual_prev = residual;
+        }
+        int Hartree_sweeps() const {
+            return sweeps_Hartree;
+        }
+        int Schrodinger_sweeps() const {
+            return sweeps_Schrodinger;
+        }
+        void Report() const { // Savings are only measured, see Measure_fixed_baseline
+            std::cout << "Inner Numerov sweeps: Hartree = " << sweeps_Hartree << "\tSchrodinger = " << sweeps_Schrodinger
+                    << "\ttotal = " << sweeps_Hartree + sweeps_Schrodinger << "\tSCF iterations = " << scf_total << " (tight = " << scf_tight << ")" << std::endl;
+        }
+    };
+
+    void Interpolate_density(const std::vector<double>& r_coarse, const std::vector<double>& density_coarse,
+                            const std::vector<double>& r_fine, std::vector<double>& density_fine, int Ntot){ // Warm start: coarse SCF density -> finer grid, normalized to Ntot
+        density_fine.assign(r_fine.size(), 0.);
+        for(std::size_t i = 0; i < r_fine.size(); ++i){
+            auto it = std::upper_bound(r_coarse.begin(), r_coarse.end(), r_fine[i]);
+            if(it == r_coarse.begin()){
+                density_fine[i] = density_coarse.front();
+                continue;
+            }
+            if(it == r_coarse.end()){
+                density_fine[i] = density_coarse.back();
+                continue;
+            }
+            std::size_t j = static_cast<std::size_t>(it - r_coarse.begin());
+            double w = (r_fine[i] - r_coarse[j - 1]) / (r_coarse[j] - r_coarse[j - 1]);
+            density_fine[i] = (1. - w) * density_coarse[j - 1] + w * density_coarse[j];
+        }
+        double density_integrate = 0.;
+        double f_iminus1, f_i, f_iplus1;
+        for (std::size_t i = 1; i < r_fine.size(); i += 2)
+        {
+            if (i == 1)
+            {
+                f_iminus1 = density_fine[i - 1] * 4. * PI * r_fine[i - 1] * r_fine[i - 1];
+            }
+            else
+            {
+                f_iminus1 = f_iplus1;
+            }
+            f_i = density_fine[i] * 4. * PI * r_fine[i] * r_fine[i];
+            f_iplus1 = density_fine[i + 1] * 4. * PI * r_fine[i + 1] * r_fine[i + 1];
+            density_integrate += (f_iminus1 + 4. * f_i + f_iplus1) * (r_fine[i + 1] - r_fine[i - 1]) / 6.;
+        }
+        double factor = static_cast<double>(Ntot) / density_integrate;
+        std::transform(density_fine.begin(), density_fine.end(), density_fine.begin(), [factor](double x)
+                    { return x * factor; });
+    }
+
+    // Richardson extrapolation of values ordered coarse -> fine, grid spacing reduced by `ratio` per level.
+    // Order is observed from the last 3 levels, never assumed (Numerov is 4th order, Simpson in r on the log grid limits it to 2).
+    // Returns false if the asymptotic range is not reached (non-monotone, order out of range, or last difference
+    // within `noise`, the SCF tolerance). Then value = finest level and error = |last difference| (conservative).
+    bool Richardson_Extrapolate(const std::vector<double>& values, double ratio, double noise, double& value, double& order, double& error){
+        const std::size_t m = values.size();
+        value = values.empty() ? 0. : values.back();
+        order = 0.;
+        error = m < 2 ? 0. : std::abs(values[m - 1] - values[m - 2]);
+        if(m < 3){
+            return false;
+        }
+        double d_coarse = values[m - 2] - values[m - 3];
+        double d_fine = values[m - 1] - values[m - 2];
+        if(std::abs(d_fine) <= 10. * noise || d_coarse * d_fine <= 0. || std::abs(d_fine) >= std::abs(d_coarse)){
+            return false;
+        }
+        double p = std::log(d_coarse / d_fine) / std::log(ratio);
+        if(p <= 0.5 || p >= 8.){
+            return false;
+        }
+        double correction = d_fine / (std::pow(ratio, p) - 1.);
+        order = p;
+        value = values[m - 1] + correction;
+        error = std::max(std::abs(correction), noise);
+        return true;
+    }
+
+    struct SCFResult {
+        bool converged;
+        int iterations;
+        int sweeps_Hartree, sweeps_Schrodinger; // Inner Numerov sweeps
+        double E_Hartree, E_ExC, Etot;
+        std::vector<OrbitalStruct> orbitals;
+        std::vector<double> r_grid;
+        std::vector<double> density;
+        std::vector<double> U_Hartree;
+    };
+    // Full SCF loop on a grid of N_grid intervals. density_guess (optional, same grid) replaces Initialize_n density.
+    // E_tol: SCF convergence threshold on |EDiff|. adaptive: inner tolerances from Tolerance_Controller, otherwise fixed.
+    // residual_guess: expected |EDiff| of density_guess, seeds Tolerance_Controller so a warm start is not solved loosely.
+    SCFResult Run_SCF(const AtomData& Atom_config, const std::string& atom_name, int N_grid = Nx,
+                      const std::vector<double>& density_guess = {}, bool write_output = true, double E_tol = E_converge,
+                      bool adaptive = Adaptive_tolerance, double residual_guess = HUGE_VAL){
         const int Ntot = Atom_config.Ntot;
         std::vector<OrbitalStruct> Atom = Atom_config.orbitals;
         const double Z_nucleus = static_cast<double>(Atom_config.Ntot);
-        InitializeStruct init = Initialize_n(Z_nucleus, Ntot);
+        InitializeStruct init = Initialize_n(Z_nucleus, Ntot, N_grid);
         std::vector<double> V_exchange(init.grid.size());
         std::vector<double> E_exchange(init.grid.size());
         std::vector<double> V_correlation(init.grid.size());
@@ -537,31 +986,54 @@
         std::vector<double> V_effective(init.grid.size());
         std::vector<double> r_grid = init.grid;
         std::vector<double> U_Hartree(init.grid.size());
-        std::vector<double> density = init.density;
+        std::vector<double> density = density_guess.size() == init.grid.size() ? density_guess : init.density;
         std::vector<double> density_prev(density.size());
         std::vector<double> TotalEnergy_history{};
-        std::cout << std::scientific << std::setprecision(5);
         int iter = 0;
         const int Iter_max_test = 200; // remove later
         int error_code;
         bool check_converge;
-        double E_Hartree_integrate, E_ExC_integrate, Etot, EDiff;
+        bool converged = false;
+        double E_Hartree_integrate = 0., E_ExC_integrate = 0., Etot = 0., EDiff;
+        Tolerance_Controller tolerance(E_tol, adaptive, residual_guess);
         while(iter < Iter_max_test){
             check_converge = true;
-            std::cout << "------Starting Main Loop Iteration = " << iter << std::endl;
-            Hartree_Numerov(r_grid, density, U_Hartree, Ntot);//step2: Update U_Hartree  //correct on log grid!
+            const InnerTolerance inner_tol = tolerance.Current();
+            const bool tight_iteration = tolerance.Is_tight();
+            int sweeps_Hartree = 0, sweeps_Schrodinger = 0;
+            std::cout << "------Starting Main Loop Iteration = " << iter << "\tSchrodinger tol_dE = "
+                    << (Channel_solver ? inner_tol.Channel_tol_dE : inner_tol.Schrodinger_tol_dE) << std::endl;
+            sweeps_Hartree += Hartree_Numerov(r_grid, density, U_Hartree, Ntot, inner_tol.Hartree_tol);//step2: Update U_Hartree  //correct on log grid!
             KS_Potential step3(r_grid, U_Hartree, density,
                             V_exchange, E_exchange, V_correlation, E_correlation, V_effective, Z_nucleus); //step3: Update this line
             step3.Wrap_effective();
-            double E_start = -150.; //@v9 -50 //@v10 -100 < P @v10 -150 < Ca
-            for(OrbitalStruct& orbital: Atom){//Step4: Update Atom
-                error_code = Solve_Schrodinger(r_grid, V_effective, orbital, E_start);
-                if(error_code != 0){
-                    check_converge = false;
+            double E_start = E_start_Schrodinger;
+            if(Channel_solver){//Step4: Update Atom, one multi-root search per l-channel
+                std::map<int, std::vector<OrbitalStruct*>> channels;
+                for(OrbitalStruct& orbital: Atom){
+                    channels[orbital.Orb_l].push_back(&orbital);
+                }
+                for(auto& channel : channels){
+                    error_code = Solve_Schrodinger_Channel(r_grid, V_effective, channel.second, E_start, sweeps_Schrodinger, inner_tol.Channel_tol_dE);
+                    if(error_code != 0){
+                        check_converge = false;
+                    }
                 }
             }
+            else{
+                for(OrbitalStruct& orbital: Atom){//Step4: Update Atom
+                    error_code = Solve_Schrodinger(r_grid, V_effective, orbital, E_start, sweeps_Schrodinger, inner_tol.Schrodinger_tol, inner_tol.Schrodinger_tol_dE);
+                    if(error_code != 0){
+                        check_converge = false;
+                    }
+                }
+            }
+            tolerance.Record(sweeps_Hartree, sweeps_Schrodinger);
             density_prev.swap(density);
             Update_density(r_grid, Atom, density);
+            if(TotalEnergy_history.empty()){ // No energy difference yet: density residual sets the first tolerance
+                tolerance.Seed(Density_residual(r_grid, density, density_prev));
+            }
             for (std::size_t i = 0; i < density.size(); ++i) {
                 density[i] = 0.5 * density[i] + 0.5 * density_prev[i];
             }
@@ -577,11 +1049,22 @@
                 std::cout << "Energy difference: Total Energy [" << iter - 1 << "] = " << TotalEnergy_history[iter - 1]
                         << "\tTotal Energy [" << (iter - 2) << "] = "  << TotalEnergy_history[iter - 2]
                         << "\tEDiff =" << EDiff << std::endl;
-                if(std::abs(EDiff) < E_converge && check_converge){
-                    std::cout << "Converged! Writing wavefunction unl ..." << std::endl;
-                    for(const OrbitalStruct& x : Atom){
-                        int Total_Nodes = x.Orb_n - x.Orb_l - 1;
-                        Write_wavefunction(x.Orb_n, x.Orb_l, Total_Nodes, x.Orb_unl, r_grid, atom_name);
+                tolerance.Update(std::abs(EDiff));
+                if(std::abs(EDiff) < E_tol && check_converge && tight_iteration){
+                    converged = true;
+                    if(write_output){
+                        std::cout << "Converged! Writing wavefunction unl ..." << std::endl;
+                        for(const OrbitalStruct& x : Atom){
+                            int Total_Nodes = x.Orb_n - x.Orb_l - 1;
+                            Write_wavefunction(x.Orb_n, x.Orb_l, Total_Nodes, x.Orb_unl, r_grid, atom_name);
+                        }
+                        if(Write_compact){
+                            for(const OrbitalStruct& x : Atom){
+                                Write_compact_radial(r_grid, x.Orb_unl, atom_name + "_n_" + std::to_string(x.Orb_n) + "_l_" + std::to_string(x.Orb_l));
+                            }
+                            Write_compact_radial(r_grid, density, atom_name + "_density");
+                            Write_compact_radial(r_grid, U_Hartree, atom_name + "_U_Hartree");
+                        }
                     }
                     std::cout << "All job done! Final atomic config:" << std::endl;
                     for(const auto& orb : Atom) {
@@ -598,6 +1081,94 @@
         // for(const OrbitalStruct& x : Atom){
         //     Write_xy(r_grid, x.Orb_unl, "10test_unl_final");
         // }
+        tolerance.Report();
+        return {converged, iter, tolerance.Hartree_sweeps(), tolerance.Schrodinger_sweeps(), E_Hartree_integrate, E_ExC_integrate, Etot, Atom, r_grid, density, U_Hartree};
+    }
+
+    // SCF on Nx / 2^(levels-1), ..., Nx/2, Nx. Each level warm starts from the coarser density.
+    // Etot, E_Hartree, E_ExC and each Orb_Enl are Richardson extrapolated to the continuum limit.
+    // Each level is converged to Richardson_E_converge so level differences are discretization error, not SCF noise.
+    int Run_Richardson(const AtomData& Atom_config, const std::string& atom_name){
+        const int levels = std::max(3, Richardson_levels); // Observed order needs 3 levels
+        const double ratio = 2.;
+        // Numerov sweeps are only stable (and node counts meaningful) for |p_KS| h^2 / 12 < 1, p_KS ~ 2 |E_start| rmax^2
+        const int N_coarse = Nx >> (levels - 1);
+        const double N_stable = (log_max - log_min) * rmax * std::sqrt(-E_start_Schrodinger / 6.);
+        if(N_coarse < N_stable){
+            std::cout << "[✘] Error: Coarsest Richardson grid Nx = " << N_coarse << " is below the Numerov stability limit Nx = "
+                    << static_cast<int>(std::ceil(N_stable)) << " (E_start = " << E_start_Schrodinger << ", rmax = " << rmax << "). Increase Nx or reduce Richardson_levels." << std::endl;
+            return 1;
+        }
+        std::vector<SCFResult> results;
+        for(int k = levels - 1; k >= 0; --k){
+            int N_grid = Nx >> k;
+            N_grid += N_grid % 2; // Simpson requires even number of intervals
+            std::vector<double> density_guess;
+            double residual_guess = HUGE_VAL; // Cold start
+            if(!results.empty()){
+                InitializeStruct init = Initialize_n(static_cast<double>(Atom_config.Ntot), Atom_config.Ntot, N_grid);
+                Interpolate_density(results.back().r_grid, results.back().density, init.grid, density_guess, Atom_config.Ntot);
+                // Warm start is off by about one level difference; unknown before the second level, start tight then
+                residual_guess = results.size() >= 2 ? std::abs(results.back().Etot - results[results.size() - 2].Etot) : Richardson_E_converge;
+            }
+            std::cout << "======Richardson level: Nx = " << N_grid << std::endl;
+            results.push_back(Run_SCF(Atom_config, atom_name, N_grid, density_guess, k == 0, Richardson_E_converge, Adaptive_tolerance, residual_guess));
+            if(!results.back().converged){
+                std::cout << "[✘] Error: SCF did not converge on Nx = " << N_grid << ". Richardson extrapolation aborted." << std::endl;
+                return 1;
+            }
+        }
+        auto Extrapolate_print = [&](const std::string& label, const std::vector<double>& values){
+            double value, order, error;
+            if(Richardson_Extrapolate(values, ratio, Richardson_E_converge, value, order, error)){
+                std::cout << "\t" << label << ":\tNx = " << Nx << " -> " << values.back() << "\tExtrapolated = " << value
+                        << "\tError estimate = " << error << "\tOrder = " << order << " (observed)" << std::endl;
+            }
+            else{
+                std::cout << "\t" << label << ":\tNx = " << Nx << " -> " << values.back() << "\tAsymptotic range not reached, no extrapolation."
+                        << "\tError estimate >= " << error << " (last level difference)" << std::endl;
+            }
+        };
+        std::vector<double> Etot_lst, E_Hartree_lst, E_ExC_lst;
+        for(const SCFResult& x : results){
+            Etot_lst.push_back(x.Etot);
+            E_Hartree_lst.push_back(x.E_Hartree);
+            E_ExC_lst.push_back(x.E_ExC);
+        }
+        std::cout << "Richardson extrapolation (" << levels << " levels, grid ratio " << ratio << "):" << std::setprecision(10) << std::endl;
+        Extrapolate_print("Total Energy", Etot_lst);
+        Extrapolate_print("E_Hartree", E_Hartree_lst);
+        Extrapolate_print("E_Exchange_Correlation", E_ExC_lst);
+        for(std::size_t i = 0; i < results.back().orbitals.size(); ++i){
+            std::vector<double> Enl_lst;
+            for(const SCFResult& x : results){
+                Enl_lst.push_back(x.orbitals[i].Orb_Enl);
+            }
+            const OrbitalStruct& orb = results.back().orbitals[i];
+            Extrapolate_print("Enl n = " + std::to_string(orb.Orb_n) + " l = " + std::to_string(orb.Orb_l), Enl_lst);
+        }
+        std::cout << std::setprecision(5);
+        return 0;
+    }
+
+    int main(){
+        auto [Atom_config, atom_name] = Select_Atom();
+        std::cout << std::scientific << std::setprecision(5);
+        if(Richardson_extrapolate){
+            return Run_Richardson(Atom_config, atom_name);
+        }
+        if(Measure_fixed_baseline && Adaptive_tolerance){
+            SCFResult fixed = Run_SCF(Atom_config, atom_name, Nx, {}, false, E_converge, false);
+            SCFResult adapt = Run_SCF(Atom_config, atom_name);
+            const int sweeps_adapt = adapt.sweeps_Hartree + adapt.sweeps_Schrodinger;
+            const int sweeps_fixed = fixed.sweeps_Hartree + fixed.sweeps_Schrodinger;
+            std::cout << "Measured: adaptive sweeps = " << sweeps_adapt << " (Hartree = " << adapt.sweeps_Hartree << ", Schrodinger = " << adapt.sweeps_Schrodinger << ", SCF = " << adapt.iterations << ")"
+                    << "\tfixed sweeps = " << sweeps_fixed << " (Hartree = " << fixed.sweeps_Hartree << ", Schrodinger = " << fixed.sweeps_Schrodinger << ", SCF = " << fixed.iterations << ")"
+                    << "\tSaved = " << sweeps_fixed - sweeps_adapt << " (" << 100. * (sweeps_fixed - sweeps_adapt) / sweeps_fixed << "%)"
+                    << "\tExtra SCF iterations = " << adapt.iterations - fixed.iterations << std::endl;
+            return 0;
+        }
+        Run_SCF(Atom_config, atom_name);
         return 0;
     }
     // Pain in the ass... :)